@@ -1,3 +1,4 @@
+#pragma once
 #include "Node.h"
 #include <iostream>
 #include <string>
@@ -24,6 +25,11 @@ namespace Tree {
 		BNode<NodeData>* setLeftChild(NodeData value);
 		BNode<NodeData>* setRightChild(NodeData value);
 
+		// re-link a child WITHOUT deleting the previous one (for rotations),
+		// the caller stays responsible for the node that was unlinked
+		BNode<NodeData>* linkLeftChild(BNode<NodeData>* node);
+		BNode<NodeData>* linkRightChild(BNode<NodeData>* node);
+
 		// utility methods
 		bool isLeafNode();
 		bool hasChildren();
@@ -105,6 +111,14 @@ namespace Tree {
 		return toBinaryNode(BNode<NodeData>::subNodes.at(1) = new BNode<NodeData>(value));
 	}
 
+	template<typename NodeData> BNode<NodeData>* BNode<NodeData>::linkLeftChild(BNode<NodeData>* node) {
+		return toBinaryNode(BNode<NodeData>::subNodes.at(0) = node);
+	}
+
+	template<typename NodeData> BNode<NodeData>* BNode<NodeData>::linkRightChild(BNode<NodeData>* node) {
+		return toBinaryNode(BNode<NodeData>::subNodes.at(1) = node);
+	}
+
 	// utility methods
 
 	template<typename NodeData> bool BNode<NodeData>::isLeafNode() {
@@ -0,0 +1,219 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+// Append-only bit vector with rank / select support, used by the succinct trees.
+//
+// Bits are packed 64 to a word. After build():
+//		blockRanks		ones before each 512-bit block (32 bits per 512 bits, ~6% extra)
+//		selectOnes		block holding every 512th one, so select starts next to its answer
+//		selectZeros		same for zeros
+// rank is one table lookup plus at most 8 popcounts; select jumps to its sampled
+// block and scans forward, which is a handful of blocks for any non-degenerate input.
+//
+// Not a template, so definitions are marked inline to stay header-only like the rest.
+
+
+namespace Tree {
+
+	class BitVector {
+
+	public:
+		static const std::uint64_t BLOCK_BITS = 512;
+		static const std::uint64_t BLOCK_WORDS = BLOCK_BITS / 64;
+
+	protected:
+		std::vector<std::uint64_t> words;
+		std::uint64_t length;
+		std::uint64_t ones;
+
+		std::vector<std::uint32_t> blockRanks;		// blockCount + 1 entries
+		std::vector<std::uint32_t> selectOnes;
+		std::vector<std::uint32_t> selectZeros;
+
+	public:
+		// constructors & destructors
+		BitVector();
+
+		// getters and setters
+		std::uint64_t getSize();
+		std::uint64_t getOneCount();
+		std::uint64_t getZeroCount();
+		bool get(std::uint64_t position);
+		void push(bool bit);
+
+		// utility methods
+
+		// builds the rank / select directories, call after the last push()
+		void build();
+
+		std::uint64_t rank1(std::uint64_t position);		// ones in [0, position)
+		std::uint64_t rank0(std::uint64_t position);		// zeros in [0, position)
+		std::uint64_t select1(std::uint64_t k);			// position of the k-th one, 0-based
+		std::uint64_t select0(std::uint64_t k);			// position of the k-th zero, 0-based
+
+		std::uint64_t getMemoryBytes();
+
+		static int popcount(std::uint64_t word);
+		static int selectInWord(std::uint64_t word, int k);
+
+	private:
+		std::uint64_t blockOnes(std::uint64_t block);
+	};
+
+
+	//
+	// class function definitions
+	//
+
+	inline BitVector::BitVector() {
+		length = 0;
+		ones = 0;
+	}
+
+	// getters and setters
+
+	inline std::uint64_t BitVector::getSize() {
+		return length;
+	}
+
+	inline std::uint64_t BitVector::getOneCount() {
+		return ones;
+	}
+
+	inline std::uint64_t BitVector::getZeroCount() {
+		return length - ones;
+	}
+
+	inline bool BitVector::get(std::uint64_t position) {
+		return (words[position >> 6] >> (position & 63)) & 1;
+	}
+
+	inline void BitVector::push(bool bit) {
+		if ((length & 63) == 0) words.push_back(0);
+		if (bit) {
+			words.back() |= std::uint64_t(1) << (length & 63);
+			ones += 1;
+		}
+		length += 1;
+	}
+
+	// utility methods
+
+	inline void BitVector::build() {
+		std::uint64_t blockCount = (words.size() + BLOCK_WORDS - 1) / BLOCK_WORDS;
+
+		blockRanks.assign(blockCount + 1, 0);
+		selectOnes.clear();
+		selectZeros.clear();
+
+		std::uint64_t onesBefore = 0;
+		std::uint64_t zerosBefore = 0;
+		for (std::uint64_t block = 0; block < blockCount; block++) {
+			blockRanks[block] = (std::uint32_t) onesBefore;
+
+			std::uint64_t blockEnd = (block + 1) * BLOCK_BITS;
+			std::uint64_t bits = (blockEnd < length ? blockEnd : length) - block * BLOCK_BITS;
+			std::uint64_t o = blockOnes(block);
+			std::uint64_t z = bits - o;
+
+			// record this block for every sampled one / zero that falls inside it
+			while (selectOnes.size() * BLOCK_BITS < onesBefore + o) selectOnes.push_back((std::uint32_t) block);
+			while (selectZeros.size() * BLOCK_BITS < zerosBefore + z) selectZeros.push_back((std::uint32_t) block);
+
+			onesBefore += o;
+			zerosBefore += z;
+		}
+		blockRanks[blockCount] = (std::uint32_t) onesBefore;
+	}
+
+	inline std::uint64_t BitVector::rank1(std::uint64_t position) {
+		if (position > length) {
+			throw std::out_of_range("BitVector: rank at " + std::to_string(position) + " past " + std::to_string(length));
+		}
+		std::uint64_t block = position / BLOCK_BITS;
+		std::uint64_t rank = blockRanks[block];
+		std::uint64_t word = block * BLOCK_WORDS;
+		for (; word < (position >> 6); word++) rank += popcount(words[word]);
+		if (position & 63) rank += popcount(words[word] & ((std::uint64_t(1) << (position & 63)) - 1));
+		return rank;
+	}
+
+	inline std::uint64_t BitVector::rank0(std::uint64_t position) {
+		return position - rank1(position);
+	}
+
+	inline std::uint64_t BitVector::select1(std::uint64_t k) {
+		if (k >= ones) {
+			throw std::out_of_range("BitVector: select1 of " + std::to_string(k) + " with " + std::to_string(ones) + " ones");
+		}
+		std::uint64_t block = selectOnes[k / BLOCK_BITS];
+		while (blockRanks[block + 1] <= k) block++;
+
+		k -= blockRanks[block];
+		for (std::uint64_t word = block * BLOCK_WORDS; ; word++) {
+			int c = popcount(words[word]);
+			if (k < (std::uint64_t) c) return word * 64 + selectInWord(words[word], (int) k);
+			k -= c;
+		}
+	}
+
+	inline std::uint64_t BitVector::select0(std::uint64_t k) {
+		if (k >= length - ones) {
+			throw std::out_of_range("BitVector: select0 of " + std::to_string(k) + " with " + std::to_string(length - ones) + " zeros");
+		}
+		std::uint64_t block = selectZeros[k / BLOCK_BITS];
+		while ((block + 1) * BLOCK_BITS - blockRanks[block + 1] <= k) block++;
+
+		// padding past length is zero too, but the k-th real zero always comes first
+		k -= block * BLOCK_BITS - blockRanks[block];
+		for (std::uint64_t word = block * BLOCK_WORDS; ; word++) {
+			int c = 64 - popcount(words[word]);
+			if (k < (std::uint64_t) c) return word * 64 + selectInWord(~words[word], (int) k);
+			k -= c;
+		}
+	}
+
+	inline std::uint64_t BitVector::getMemoryBytes() {
+		return words.size() * sizeof(std::uint64_t)
+			+ (blockRanks.size() + selectOnes.size() + selectZeros.size()) * sizeof(std::uint32_t);
+	}
+
+	// portable popcount (no compiler intrinsics)
+	inline int BitVector::popcount(std::uint64_t word) {
+		word = word - ((word >> 1) & 0x5555555555555555ULL);
+		word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+		word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return (int) ((word * 0x0101010101010101ULL) >> 56);
+	}
+
+	// position of the k-th set bit of word, 0-based; k < popcount(word)
+	inline int BitVector::selectInWord(std::uint64_t word, int k) {
+		int position = 0;
+		while (true) {
+			int c = popcount(word & 0xFF);
+			if (k < c) break;
+			k -= c;
+			word >>= 8;
+			position += 8;
+		}
+		for (;; position++, word >>= 1) {
+			if (word & 1) {
+				if (k == 0) return position;
+				k -= 1;
+			}
+		}
+	}
+
+	// private helpers
+
+	inline std::uint64_t BitVector::blockOnes(std::uint64_t block) {
+		std::uint64_t count = 0;
+		std::uint64_t end = (block + 1) * BLOCK_WORDS;
+		if (end > words.size()) end = words.size();
+		for (std::uint64_t word = block * BLOCK_WORDS; word < end; word++) count += popcount(words[word]);
+		return count;
+	}
+}
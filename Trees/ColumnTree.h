@@ -0,0 +1,257 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <iostream>
+#include "BNode.h"
+#include "Tree.h"
+
+// Column (structure-of-arrays) storage for a general tree.
+//
+// A Node<NodeData> keeps its value next to a vtable pointer and a subNodes vector,
+// so a scan over values pulls all of that through the cache as well.
+// Here the tree is split into parallel arrays indexed by a 32-bit node index:
+//		values[i]						payload of node i
+//		parents[i]						index of the parent of node i (NO_NODE for the root)
+//		childBegin[i], childBegin[i+1]	children of node i are the indices in that range
+// Nodes are numbered in level-order, so the children of a node are always
+// contiguous and value-only scans (sumValues, countValues, ...) walk one flat array.
+//
+// NULL sub-nodes (e.g. a BNode's missing child) are not stored; converting back
+// gives plain Node<NodeData> objects holding only the valid sub-nodes.
+
+
+namespace Tree {
+
+	template<typename NodeData> class ColumnTree {
+
+	public:
+		typedef std::uint32_t Index;
+		static const Index NO_NODE = 0xFFFFFFFFu;
+
+	protected:
+		std::vector<NodeData> values;
+		std::vector<Index> parents;
+		std::vector<Index> childBegin;		// getNodeCount() + 1 entries
+
+	public:
+		// constructors & destructors
+		ColumnTree();
+		ColumnTree(Node<NodeData>* root);
+		ColumnTree(Tree<NodeData>* tree);
+
+		// getters and setters
+		Index getNodeCount();
+		Index getRootNode();				// NO_NODE if empty
+		NodeData getValue(Index node);
+		void setValue(Index node, NodeData value);
+		Index getParent(Index node);
+		int getSubNodeCount(Index node);
+		Index getSubNode(Index node, int index);
+
+		// level-order values, contiguous
+		const std::vector<NodeData>& getDataList();
+
+		// utility methods
+
+		// value-only scans, these never touch the topology arrays
+		NodeData sumValues();
+		template<typename Predicate> Index countValues(Predicate predicate);
+		template<typename Predicate> std::vector<Index> findValues(Predicate predicate);
+
+		int getNodeLevel(Index node);		// from root to node
+		int getNodeHeight(Index node);		// from node to lowest leaf
+
+		// conversion back to linked nodes (new heap nodes, caller owns them)
+		Node<NodeData>* toNodes();
+		Tree<NodeData>* toTree();
+
+		void printTree();
+
+	private:
+		void checkNode(Index node);
+	};
+
+
+	//
+	// class function definitions
+	//
+
+	template<typename NodeData> const typename ColumnTree<NodeData>::Index ColumnTree<NodeData>::NO_NODE;
+
+	template<typename NodeData> ColumnTree<NodeData>::ColumnTree() {
+		childBegin.push_back(0);
+	}
+
+	template<typename NodeData> ColumnTree<NodeData>::ColumnTree(Node<NodeData>* root) {
+
+		// level-order walk; order[i] is the node that gets index i
+		std::vector<Node<NodeData>*> order;
+		if (root != NULL) {
+			order.push_back(root);
+			parents.push_back(NO_NODE);
+		}
+
+		for (std::size_t i = 0; i < order.size(); i++) {
+			Node<NodeData>* n = order[i];
+			values.push_back(n->getValue());
+
+			// children of node i get the next free indices, so they stay contiguous
+			childBegin.push_back((Index) order.size());
+			for (Node<NodeData>* sub : n->getValidSubNodes()) {
+				order.push_back(sub);
+				parents.push_back((Index) i);
+			}
+		}
+		childBegin.push_back((Index) order.size());
+
+		if (order.size() >= NO_NODE) {
+			throw std::length_error("ColumnTree: more than 2^32 - 1 nodes");
+		}
+	}
+
+	template<typename NodeData> ColumnTree<NodeData>::ColumnTree(Tree<NodeData>* tree)
+	: ColumnTree(tree == NULL ? NULL : tree->getRootNode()) {
+	}
+
+	// getters and setters
+
+	template<typename NodeData> typename ColumnTree<NodeData>::Index ColumnTree<NodeData>::getNodeCount() {
+		return (Index) values.size();
+	}
+
+	template<typename NodeData> typename ColumnTree<NodeData>::Index ColumnTree<NodeData>::getRootNode() {
+		return values.empty() ? NO_NODE : 0;
+	}
+
+	template<typename NodeData> NodeData ColumnTree<NodeData>::getValue(Index node) {
+		checkNode(node);
+		return values[node];
+	}
+
+	template<typename NodeData> void ColumnTree<NodeData>::setValue(Index node, NodeData value) {
+		checkNode(node);
+		values[node] = value;
+	}
+
+	template<typename NodeData> typename ColumnTree<NodeData>::Index ColumnTree<NodeData>::getParent(Index node) {
+		checkNode(node);
+		return parents[node];
+	}
+
+	template<typename NodeData> int ColumnTree<NodeData>::getSubNodeCount(Index node) {
+		checkNode(node);
+		return (int) (childBegin[node + 1] - childBegin[node]);
+	}
+
+	template<typename NodeData> typename ColumnTree<NodeData>::Index ColumnTree<NodeData>::getSubNode(Index node, int index) {
+		if (index < 0 || index >= getSubNodeCount(node)) {
+			throw std::out_of_range("ColumnTree: sub-node " + std::to_string(index) + " of node " + std::to_string(node));
+		}
+		return childBegin[node] + index;
+	}
+
+	template<typename NodeData> const std::vector<NodeData>& ColumnTree<NodeData>::getDataList() {
+		return values;
+	}
+
+	// utility methods
+
+	template<typename NodeData> NodeData ColumnTree<NodeData>::sumValues() {
+		NodeData sum = NodeData();
+		const NodeData* v = values.data();
+		std::size_t count = values.size();
+		for (std::size_t i = 0; i < count; i++) {
+			sum += v[i];
+		}
+		return sum;
+	}
+
+	template<typename NodeData> template<typename Predicate> typename ColumnTree<NodeData>::Index ColumnTree<NodeData>::countValues(Predicate predicate) {
+		Index matches = 0;
+		const NodeData* v = values.data();
+		std::size_t count = values.size();
+		for (std::size_t i = 0; i < count; i++) {
+			matches += predicate(v[i]) ? 1 : 0;
+		}
+		return matches;
+	}
+
+	template<typename NodeData> template<typename Predicate> std::vector<typename ColumnTree<NodeData>::Index> ColumnTree<NodeData>::findValues(Predicate predicate) {
+		std::vector<Index> matches;
+		std::size_t count = values.size();
+		for (std::size_t i = 0; i < count; i++) {
+			if (predicate(values[i])) matches.push_back((Index) i);
+		}
+		return matches;
+	}
+
+	template<typename NodeData> int ColumnTree<NodeData>::getNodeLevel(Index node) {
+		checkNode(node);
+		int level = 0;
+		while (parents[node] != NO_NODE) {
+			node = parents[node];
+			level += 1;
+		}
+		return level;
+	}
+
+	template<typename NodeData> int ColumnTree<NodeData>::getNodeHeight(Index node) {
+		checkNode(node);
+
+		// level-order numbering: the subtree of node, level by level, is a run of
+		// contiguous index ranges, each one the children of the previous range
+		int height = 0;
+		Index first = node;
+		Index last = node + 1;
+		while (true) {
+			Index nextFirst = childBegin[first];
+			Index nextLast = childBegin[last];
+			if (nextFirst == nextLast) break;
+			first = nextFirst;
+			last = nextLast;
+			height += 1;
+		}
+		return height;
+	}
+
+	template<typename NodeData> Node<NodeData>* ColumnTree<NodeData>::toNodes() {
+		if (values.empty()) return NULL;
+
+		std::vector<Node<NodeData>*> nodes;
+		nodes.reserve(values.size());
+		for (std::size_t i = 0; i < values.size(); i++) {
+			nodes.push_back(new Node<NodeData>(values[i]));
+		}
+		for (std::size_t i = 0; i < values.size(); i++) {
+			for (Index c = childBegin[i]; c < childBegin[i + 1]; c++) {
+				nodes[i]->addSubNode(nodes[c]);
+			}
+		}
+		return nodes[0];
+	}
+
+	template<typename NodeData> Tree<NodeData>* ColumnTree<NodeData>::toTree() {
+		return new Tree<NodeData>(toNodes());
+	}
+
+	template<typename NodeData> void ColumnTree<NodeData>::printTree() {
+		for (std::size_t i = 0; i < values.size(); i++) {
+			std::cout << "[" << i << "] " << values[i] << " ->";
+			for (Index c = childBegin[i]; c < childBegin[i + 1]; c++) {
+				std::cout << " " << c;
+			}
+			std::cout << std::endl;
+		}
+	}
+
+	// private helpers
+
+	template<typename NodeData> void ColumnTree<NodeData>::checkNode(Index node) {
+		if (node >= values.size()) {
+			throw std::out_of_range("ColumnTree: node " + std::to_string(node)
+				+ " outside [0, " + std::to_string(values.size()) + ")");
+		}
+	}
+}
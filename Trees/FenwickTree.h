@@ -0,0 +1,165 @@
+#pragma once
+#include <vector>
+#include <stdexcept>
+#include <string>
+#include <iostream>
+
+// Fenwick tree (binary indexed tree) with range-add and range-sum.
+//
+// Unlike SegmentTree, a Fenwick tree answers [from, to) as prefix(to) - prefix(from),
+// so it needs an invertible combine; it is therefore written for sums only
+// (NodeData must support +, - and * int). In exchange it is a single flat array
+// of n + 1 values per buffer, with no padding to a power of two.
+//
+// Range-add is done with the usual two-buffer trick:
+//		prefix(i) = sum(base, i) * i - sum(scaled, i)
+// where a range-add of v on [l, r) adds v at l / -v at r in base,
+// and v * l / -v * r in scaled.
+
+
+namespace Tree {
+
+	template<typename NodeData> class FenwickTree {
+
+	protected:
+		int count;							// number of elements
+		std::vector<NodeData> base;			// 1-indexed, count + 1
+		std::vector<NodeData> scaled;		// 1-indexed, count + 1
+
+	public:
+		// constructors & destructors
+		FenwickTree(int n);									// n zero elements
+		FenwickTree(const std::vector<NodeData>& values);	// O(n) bulk build
+
+		// getters and setters
+		int getSize();
+		NodeData get(int index);
+
+		// utility methods
+
+		// element index += delta, O(log n)
+		void add(int index, NodeData delta);
+
+		// elements in [from, to) += delta, O(log n)
+		void add(int from, int to, NodeData delta);
+
+		// sum of elements in [0, to), O(log n)
+		NodeData prefix(int to);
+
+		// sum of elements in [from, to), O(log n)
+		NodeData query(int from, int to);
+
+		std::vector<NodeData> getDataList();
+
+		void printTree();
+
+	private:
+		void addAt(std::vector<NodeData>& tree, int position, NodeData delta);
+		NodeData sumTo(const std::vector<NodeData>& tree, int position);
+		void checkRange(int from, int to);
+	};
+
+
+	//
+	// class function definitions
+	//
+
+	template<typename NodeData> FenwickTree<NodeData>::FenwickTree(int n) {
+		count = n < 0 ? 0 : n;
+		base.assign(count + 1, NodeData());
+		scaled.assign(count + 1, NodeData());
+	}
+
+	template<typename NodeData> FenwickTree<NodeData>::FenwickTree(const std::vector<NodeData>& values) {
+		count = values.size();
+		base.assign(count + 1, NodeData());
+
+		// initial values live entirely in scaled (as -prefix contributions);
+		// build it in O(n) by pushing each slot into its parent once
+		scaled.assign(count + 1, NodeData());
+		for (int i = 1; i <= count; i++) {
+			scaled[i] = scaled[i] - values[i - 1];
+			int parent = i + (i & -i);
+			if (parent <= count) scaled[parent] = scaled[parent] + scaled[i];
+		}
+	}
+
+	// getters and setters
+
+	template<typename NodeData> int FenwickTree<NodeData>::getSize() {
+		return count;
+	}
+
+	template<typename NodeData> NodeData FenwickTree<NodeData>::get(int index) {
+		return query(index, index + 1);
+	}
+
+	// utility methods
+
+	template<typename NodeData> void FenwickTree<NodeData>::add(int index, NodeData delta) {
+		checkRange(index, index + 1);
+		// a point update is a range update of width 1, but only scaled has to change
+		addAt(scaled, index + 1, NodeData() - delta);
+	}
+
+	template<typename NodeData> void FenwickTree<NodeData>::add(int from, int to, NodeData delta) {
+		checkRange(from, to);
+		if (from == to) return;
+		addAt(base, from + 1, delta);
+		addAt(base, to + 1, NodeData() - delta);
+		addAt(scaled, from + 1, delta * from);
+		addAt(scaled, to + 1, NodeData() - delta * to);
+	}
+
+	template<typename NodeData> NodeData FenwickTree<NodeData>::prefix(int to) {
+		checkRange(0, to);
+		return sumTo(base, to) * to - sumTo(scaled, to);
+	}
+
+	template<typename NodeData> NodeData FenwickTree<NodeData>::query(int from, int to) {
+		checkRange(from, to);
+		return prefix(to) - prefix(from);
+	}
+
+	template<typename NodeData> std::vector<NodeData> FenwickTree<NodeData>::getDataList() {
+		std::vector<NodeData> values;
+		values.reserve(count);
+		NodeData previous = NodeData();
+		for (int i = 1; i <= count; i++) {
+			NodeData current = prefix(i);
+			values.push_back(current - previous);
+			previous = current;
+		}
+		return values;
+	}
+
+	template<typename NodeData> void FenwickTree<NodeData>::printTree() {
+		std::vector<NodeData> values = getDataList();
+		for (NodeData v : values) std::cout << v << " ";
+		std::cout << std::endl;
+	}
+
+	// private helpers
+
+	// position is 1-indexed; position == count + 1 is a no-op (past the end)
+	template<typename NodeData> void FenwickTree<NodeData>::addAt(std::vector<NodeData>& tree, int position, NodeData delta) {
+		for (; position <= count; position += position & -position) {
+			tree[position] = tree[position] + delta;
+		}
+	}
+
+	template<typename NodeData> NodeData FenwickTree<NodeData>::sumTo(const std::vector<NodeData>& tree, int position) {
+		NodeData sum = NodeData();
+		for (; position > 0; position -= position & -position) {
+			sum = sum + tree[position];
+		}
+		return sum;
+	}
+
+	template<typename NodeData> void FenwickTree<NodeData>::checkRange(int from, int to) {
+		if (from < 0 || to > count || from > to) {
+			throw std::out_of_range("FenwickTree: range [" + std::to_string(from) + ", "
+				+ std::to_string(to) + ") outside [0, " + std::to_string(count) + ")");
+		}
+	}
+}
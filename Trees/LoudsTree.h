@@ -0,0 +1,247 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <iostream>
+#include "BNode.h"
+#include "Tree.h"
+#include "BitVector.h"
+
+// Read-only succinct tree in LOUDS form (level-order unary degree sequence).
+//
+// The topology is one bit vector: "10" for a virtual super-root, then for every
+// node in level-order as many 1s as it has sub-nodes followed by a 0.
+// That is 2n + 1 bits for n nodes plus the BitVector directories (~2.2 bits per node).
+// Node ids are level-order indices, the same numbering ColumnTree uses:
+//		node x is the x-th 1 in the sequence
+//		sub-nodes of x are the ids [select0(x) - x, select0(x + 1) - x - 1)
+//		parent of x is select1(x) - x - 1
+// so navigation is a single select (or two) per step.
+// Payloads are kept separately in level-order and do not count toward the topology.
+//
+// NULL sub-nodes are skipped, like ColumnTree.
+
+
+namespace Tree {
+
+	template<typename NodeData> class LoudsTree {
+
+	public:
+		typedef std::uint32_t Index;
+		static const Index NO_NODE = 0xFFFFFFFFu;
+
+	protected:
+		BitVector bits;
+		std::vector<NodeData> values;
+		std::vector<Index> levelStart;		// first node id of every level, for getNodeLevel
+
+	public:
+		// constructors & destructors
+		LoudsTree(Node<NodeData>* root);
+		LoudsTree(Tree<NodeData>* tree);
+
+		// getters and setters
+		Index getNodeCount();
+		Index getRootNode();				// NO_NODE if empty
+		NodeData getValue(Index node);
+
+		Index getParent(Index node);		// NO_NODE for the root
+		int getSubNodeCount(Index node);
+		Index getSubNode(Index node, int index);
+		Index getFirstSubNode(Index node);	// NO_NODE for a leaf
+		Index getNextSibling(Index node);	// NO_NODE for the last sub-node
+		Index getPrevSibling(Index node);	// NO_NODE for the first sub-node
+
+		// level-order values
+		const std::vector<NodeData>& getDataList();
+
+		// utility methods
+		bool isLeafNode(Index node);
+
+		int getNodeLevel(Index node);		// from root to node
+		int getNodeHeight(Index node);		// from node to lowest leaf
+		int getTreeHeight();
+
+		// topology bits plus rank / select directories, payload excluded
+		std::uint64_t getTopologyBytes();
+
+		void printTree();
+
+	private:
+		Index subNodesBegin(Index node);
+		void checkNode(Index node);
+	};
+
+
+	//
+	// class function definitions
+	//
+
+	template<typename NodeData> const typename LoudsTree<NodeData>::Index LoudsTree<NodeData>::NO_NODE;
+
+	template<typename NodeData> LoudsTree<NodeData>::LoudsTree(Node<NodeData>* root) {
+
+		// super-root with a single sub-node: the real root
+		bits.push(true);
+		bits.push(false);
+
+		// level-order walk; order[i] is the node that gets id i
+		std::vector<Node<NodeData>*> order;
+		if (root != NULL) {
+			order.push_back(root);
+			levelStart.push_back(0);
+		}
+		std::size_t levelEnd = order.size();
+
+		for (std::size_t i = 0; i < order.size(); i++) {
+
+			// first node of a new level
+			if (i == levelEnd) {
+				levelStart.push_back((Index) i);
+				levelEnd = order.size();
+			}
+
+			Node<NodeData>* n = order[i];
+			values.push_back(n->getValue());
+
+			for (Node<NodeData>* sub : n->getValidSubNodes()) {
+				order.push_back(sub);
+				bits.push(true);
+			}
+			bits.push(false);
+		}
+
+		if (order.size() >= NO_NODE) {
+			throw std::length_error("LoudsTree: more than 2^32 - 1 nodes");
+		}
+
+		bits.build();
+	}
+
+	template<typename NodeData> LoudsTree<NodeData>::LoudsTree(Tree<NodeData>* tree)
+	: LoudsTree(tree == NULL ? NULL : tree->getRootNode()) {
+	}
+
+	// getters and setters
+
+	template<typename NodeData> typename LoudsTree<NodeData>::Index LoudsTree<NodeData>::getNodeCount() {
+		return (Index) values.size();
+	}
+
+	template<typename NodeData> typename LoudsTree<NodeData>::Index LoudsTree<NodeData>::getRootNode() {
+		return values.empty() ? NO_NODE : 0;
+	}
+
+	template<typename NodeData> NodeData LoudsTree<NodeData>::getValue(Index node) {
+		checkNode(node);
+		return values[node];
+	}
+
+	template<typename NodeData> typename LoudsTree<NodeData>::Index LoudsTree<NodeData>::getParent(Index node) {
+		checkNode(node);
+		if (node == 0) return NO_NODE;
+		return (Index) (bits.select1(node) - node - 1);
+	}
+
+	template<typename NodeData> int LoudsTree<NodeData>::getSubNodeCount(Index node) {
+		checkNode(node);
+		return (int) (subNodesBegin(node + 1) - subNodesBegin(node));
+	}
+
+	template<typename NodeData> typename LoudsTree<NodeData>::Index LoudsTree<NodeData>::getSubNode(Index node, int index) {
+		if (index < 0 || index >= getSubNodeCount(node)) {
+			throw std::out_of_range("LoudsTree: sub-node " + std::to_string(index) + " of node " + std::to_string(node));
+		}
+		return subNodesBegin(node) + index;
+	}
+
+	template<typename NodeData> typename LoudsTree<NodeData>::Index LoudsTree<NodeData>::getFirstSubNode(Index node) {
+		checkNode(node);
+		// node's run of 1s starts right after the (node)-th 0; an immediate 0 means a leaf
+		std::uint64_t position = bits.select0(node) + 1;
+		if (!bits.get(position)) return NO_NODE;
+		return (Index) (position - node - 1);
+	}
+
+	template<typename NodeData> typename LoudsTree<NodeData>::Index LoudsTree<NodeData>::getNextSibling(Index node) {
+		checkNode(node);
+		if (node == 0) return NO_NODE;
+		return bits.get(bits.select1(node) + 1) ? node + 1 : NO_NODE;
+	}
+
+	template<typename NodeData> typename LoudsTree<NodeData>::Index LoudsTree<NodeData>::getPrevSibling(Index node) {
+		checkNode(node);
+		if (node == 0) return NO_NODE;
+		return bits.get(bits.select1(node) - 1) ? node - 1 : NO_NODE;
+	}
+
+	template<typename NodeData> const std::vector<NodeData>& LoudsTree<NodeData>::getDataList() {
+		return values;
+	}
+
+	// utility methods
+
+	template<typename NodeData> bool LoudsTree<NodeData>::isLeafNode(Index node) {
+		return getFirstSubNode(node) == NO_NODE;
+	}
+
+	template<typename NodeData> int LoudsTree<NodeData>::getNodeLevel(Index node) {
+		checkNode(node);
+		// levels are contiguous id ranges in level-order
+		return (int) (std::upper_bound(levelStart.begin(), levelStart.end(), node) - levelStart.begin()) - 1;
+	}
+
+	template<typename NodeData> int LoudsTree<NodeData>::getNodeHeight(Index node) {
+		checkNode(node);
+
+		// the descendants of node on each level form one contiguous id range,
+		// the sub-nodes of the previous range
+		int height = 0;
+		Index first = node;
+		Index last = node + 1;
+		while (true) {
+			Index nextFirst = subNodesBegin(first);
+			Index nextLast = subNodesBegin(last);
+			if (nextFirst == nextLast) break;
+			first = nextFirst;
+			last = nextLast;
+			height += 1;
+		}
+		return height;
+	}
+
+	template<typename NodeData> int LoudsTree<NodeData>::getTreeHeight() {
+		return (int) levelStart.size() - 1;
+	}
+
+	template<typename NodeData> std::uint64_t LoudsTree<NodeData>::getTopologyBytes() {
+		return bits.getMemoryBytes() + levelStart.size() * sizeof(Index);
+	}
+
+	template<typename NodeData> void LoudsTree<NodeData>::printTree() {
+		for (Index i = 0; i < getNodeCount(); i++) {
+			std::cout << "[" << i << "] " << values[i] << " ->";
+			for (Index c = subNodesBegin(i); c < subNodesBegin(i + 1); c++) {
+				std::cout << " " << c;
+			}
+			std::cout << std::endl;
+		}
+	}
+
+	// private helpers
+
+	// id of the first sub-node of node, or where it would be if node is a leaf;
+	// valid for node == getNodeCount() as well (returns getNodeCount())
+	template<typename NodeData> typename LoudsTree<NodeData>::Index LoudsTree<NodeData>::subNodesBegin(Index node) {
+		return (Index) (bits.select0(node) - node);
+	}
+
+	template<typename NodeData> void LoudsTree<NodeData>::checkNode(Index node) {
+		if (node >= values.size()) {
+			throw std::out_of_range("LoudsTree: node " + std::to_string(node)
+				+ " outside [0, " + std::to_string(values.size()) + ")");
+		}
+	}
+}
@@ -0,0 +1,247 @@
+#pragma once
+#include <vector>
+#include <limits>
+#include <stdexcept>
+#include <algorithm>
+#include <string>
+#include <iostream>
+
+// Array-based segment tree with lazy range-assignment.
+//
+// Uses the same implicit layout a complete BinaryTree has in level-order:
+// node k has its children at 2k and 2k+1, root at 1, leaves at [size, 2*size).
+// Everything (build, update, query) is done bottom-up with plain loops,
+// so there is no recursion and no per-node allocation.
+//
+// The tree is generic over a monoid, given as a struct with static members:
+//		NodeData identity();								// e with combine(e, x) == x
+//		NodeData combine(NodeData a, NodeData b);			// associative
+//		NodeData repeat(NodeData value, int count);			// combine of value with itself count times
+// repeat() is what a node of length count holds after a range-assign,
+// e.g. value * count for sums, value for min / max.
+
+
+namespace Tree {
+
+	// ready-made monoids
+
+	template<typename NodeData> struct SumMonoid {
+		static NodeData identity() { return NodeData(); }
+		static NodeData combine(NodeData a, NodeData b) { return a + b; }
+		static NodeData repeat(NodeData value, int count) { return value * count; }
+	};
+
+	template<typename NodeData> struct MinMonoid {
+		static NodeData identity() { return std::numeric_limits<NodeData>::max(); }
+		static NodeData combine(NodeData a, NodeData b) { return b < a ? b : a; }
+		static NodeData repeat(NodeData value, int /*count*/) { return value; }
+	};
+
+	template<typename NodeData> struct MaxMonoid {
+		static NodeData identity() { return std::numeric_limits<NodeData>::lowest(); }
+		static NodeData combine(NodeData a, NodeData b) { return a < b ? b : a; }
+		static NodeData repeat(NodeData value, int /*count*/) { return value; }
+	};
+
+
+	template<typename NodeData, typename Monoid = SumMonoid<NodeData>> class SegmentTree {
+
+	protected:
+		int count;							// number of elements
+		int size;							// leaf count, power of two >= count
+		int height;							// log2(size), i.e. height of the tree
+
+		std::vector<NodeData> data;			// aggregates, 1-indexed, 2 * size
+		std::vector<NodeData> lazy;			// pending assignment for internal nodes
+		std::vector<char> tagged;			// whether lazy[k] is pending (char, not vector<bool>)
+
+	public:
+		// constructors & destructors
+		SegmentTree(int n);								// n elements, all identity
+		SegmentTree(const std::vector<NodeData>& values);	// O(n) bulk build
+
+		// getters and setters
+		int getSize();
+		NodeData get(int index);
+		void set(int index, NodeData value);			// O(log n)
+
+		// utility methods
+
+		// combine of elements in [from, to), O(log n)
+		NodeData query(int from, int to);
+		NodeData queryAll();
+
+		// elements in [from, to) all become value, O(log n)
+		void assign(int from, int to, NodeData value);
+
+		// element list in index order (pushes all pending assignments)
+		std::vector<NodeData> getDataList();
+
+		void printTree();
+
+	private:
+		void build();
+		void pull(int k);
+		void applyAssign(int k, NodeData value, int length);
+		void push(int k, int length);
+		void pushPath(int leaf);
+		void checkRange(int from, int to);
+	};
+
+
+	//
+	// class function definitions
+	//
+
+	template<typename NodeData, typename Monoid> SegmentTree<NodeData, Monoid>::SegmentTree(int n)
+	: SegmentTree(std::vector<NodeData>(n < 0 ? 0 : n, Monoid::identity())) {
+	}
+
+	template<typename NodeData, typename Monoid> SegmentTree<NodeData, Monoid>::SegmentTree(const std::vector<NodeData>& values) {
+		count = values.size();
+		size = 1;
+		height = 0;
+		while (size < count) {
+			size <<= 1;
+			height += 1;
+		}
+
+		data.assign(2 * size, Monoid::identity());
+		lazy.assign(size, Monoid::identity());
+		tagged.assign(size, 0);
+
+		// leaves first, then every parent from the bottom up
+		std::copy(values.begin(), values.end(), data.begin() + size);
+		build();
+	}
+
+	// getters and setters
+
+	template<typename NodeData, typename Monoid> int SegmentTree<NodeData, Monoid>::getSize() {
+		return count;
+	}
+
+	template<typename NodeData, typename Monoid> NodeData SegmentTree<NodeData, Monoid>::get(int index) {
+		checkRange(index, index + 1);
+		int leaf = index + size;
+		pushPath(leaf);
+		return data[leaf];
+	}
+
+	template<typename NodeData, typename Monoid> void SegmentTree<NodeData, Monoid>::set(int index, NodeData value) {
+		checkRange(index, index + 1);
+		int leaf = index + size;
+		pushPath(leaf);
+		data[leaf] = value;
+		for (int i = 1; i <= height; i++) pull(leaf >> i);
+	}
+
+	// utility methods
+
+	template<typename NodeData, typename Monoid> NodeData SegmentTree<NodeData, Monoid>::query(int from, int to) {
+		checkRange(from, to);
+		if (from == to) return Monoid::identity();
+
+		int l = from + size;
+		int r = to + size;
+
+		// only the two boundary paths can hold assignments that haven't reached us yet
+		for (int i = height; i >= 1; i--) {
+			if (((l >> i) << i) != l) push(l >> i, 1 << i);
+			if (((r >> i) << i) != r) push((r - 1) >> i, 1 << i);
+		}
+
+		// combine is not assumed commutative, so keep left and right parts apart
+		NodeData left = Monoid::identity();
+		NodeData right = Monoid::identity();
+		while (l < r) {
+			if (l & 1) left = Monoid::combine(left, data[l++]);
+			if (r & 1) right = Monoid::combine(data[--r], right);
+			l >>= 1;
+			r >>= 1;
+		}
+		return Monoid::combine(left, right);
+	}
+
+	template<typename NodeData, typename Monoid> NodeData SegmentTree<NodeData, Monoid>::queryAll() {
+		return data[1];
+	}
+
+	template<typename NodeData, typename Monoid> void SegmentTree<NodeData, Monoid>::assign(int from, int to, NodeData value) {
+		checkRange(from, to);
+		if (from == to) return;
+
+		int l = from + size;
+		int r = to + size;
+
+		for (int i = height; i >= 1; i--) {
+			if (((l >> i) << i) != l) push(l >> i, 1 << i);
+			if (((r >> i) << i) != r) push((r - 1) >> i, 1 << i);
+		}
+
+		// tag the O(log n) nodes that exactly cover [from, to)
+		int length = 1;
+		for (int a = l, b = r; a < b; a >>= 1, b >>= 1, length <<= 1) {
+			if (a & 1) applyAssign(a++, value, length);
+			if (b & 1) applyAssign(--b, value, length);
+		}
+
+		// then fix the aggregates above the two boundaries
+		for (int i = 1; i <= height; i++) {
+			if (((l >> i) << i) != l) pull(l >> i);
+			if (((r >> i) << i) != r) pull((r - 1) >> i);
+		}
+	}
+
+	template<typename NodeData, typename Monoid> std::vector<NodeData> SegmentTree<NodeData, Monoid>::getDataList() {
+		// top-down over the level-order array pushes every tag before its children are read
+		for (int k = 1, length = size; k < size; k++) {
+			if ((k & (k - 1)) == 0 && k > 1) length >>= 1;
+			push(k, length);
+		}
+		return std::vector<NodeData>(data.begin() + size, data.begin() + size + count);
+	}
+
+	template<typename NodeData, typename Monoid> void SegmentTree<NodeData, Monoid>::printTree() {
+		std::vector<NodeData> values = getDataList();
+		for (NodeData v : values) std::cout << v << " ";
+		std::cout << std::endl;
+	}
+
+	// private helpers
+
+	template<typename NodeData, typename Monoid> void SegmentTree<NodeData, Monoid>::build() {
+		for (int k = size - 1; k >= 1; k--) pull(k);
+	}
+
+	template<typename NodeData, typename Monoid> void SegmentTree<NodeData, Monoid>::pull(int k) {
+		data[k] = Monoid::combine(data[2 * k], data[2 * k + 1]);
+	}
+
+	template<typename NodeData, typename Monoid> void SegmentTree<NodeData, Monoid>::applyAssign(int k, NodeData value, int length) {
+		data[k] = Monoid::repeat(value, length);
+		if (k < size) {
+			lazy[k] = value;
+			tagged[k] = 1;
+		}
+	}
+
+	// length is the number of leaves under node k
+	template<typename NodeData, typename Monoid> void SegmentTree<NodeData, Monoid>::push(int k, int length) {
+		if (!tagged[k]) return;
+		applyAssign(2 * k, lazy[k], length >> 1);
+		applyAssign(2 * k + 1, lazy[k], length >> 1);
+		tagged[k] = 0;
+	}
+
+	template<typename NodeData, typename Monoid> void SegmentTree<NodeData, Monoid>::pushPath(int leaf) {
+		for (int i = height; i >= 1; i--) push(leaf >> i, 1 << i);
+	}
+
+	template<typename NodeData, typename Monoid> void SegmentTree<NodeData, Monoid>::checkRange(int from, int to) {
+		if (from < 0 || to > count || from > to) {
+			throw std::out_of_range("SegmentTree: range [" + std::to_string(from) + ", "
+				+ std::to_string(to) + ") outside [0, " + std::to_string(count) + ")");
+		}
+	}
+}
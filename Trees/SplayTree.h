@@ -0,0 +1,244 @@
+#pragma once
+#include <vector>
+#include <iostream>
+#include "BNode.h"
+#include "BinaryTree.h"
+
+// Self-adjusting binary search tree (splay tree) over BNode.
+//
+// Every find / insert / remove splays the key it touched to the root, so
+// frequently accessed keys stay near the top and skewed (e.g. Zipfian) access
+// costs close to O(1) amortized; any sequence is still O(log n) amortized.
+//
+// Splaying is top-down (Sleator & Tarjan): a single pass from the root that
+// peels the search path off into a left tree (keys < key) and a right tree (keys > key),
+// then reassembles them under the last node reached. No recursion, no parent pointers.
+//
+// NodeData needs operator< and a default constructor. Duplicates are ignored.
+
+
+namespace Tree {
+
+	template<typename NodeData> class SplayTree : public BinaryTree<NodeData> {
+
+	protected:
+		int nodeCount;
+		BNode<NodeData>* header;		// scratch node reused by splay(), never part of the tree
+
+	public:
+		// constructors & destructors
+		SplayTree();
+		SplayTree(NodeData rootVal);
+		~SplayTree();
+
+		// getters and setters
+		int getNodeCount();
+
+		// utility methods
+
+		// BST insert (overrides the level-order BinaryTree insert), the inserted node
+		// becomes the root; insert(val) returns the existing node for a duplicate,
+		// insert(node) returns NULL and leaves node to the caller
+		BNode<NodeData>* insert(NodeData val);
+		BNode<NodeData>* insert(BNode<NodeData>* node);
+
+		// node holding key (now the root), NULL if not found
+		BNode<NodeData>* find(NodeData key);
+		bool contains(NodeData key);
+
+		// true if key was found and deleted
+		bool remove(NodeData key);
+
+	private:
+		// brings key, or the last node on its search path, to the top of t
+		BNode<NodeData>* splay(BNode<NodeData>* t, NodeData key);
+		BNode<NodeData>* attachAtRoot(BNode<NodeData>* node);
+	};
+
+
+	//
+	// class function definitions
+	//
+
+	template<typename NodeData> SplayTree<NodeData>::SplayTree() : BinaryTree<NodeData>() {
+		nodeCount = 0;
+		header = new BNode<NodeData>(NodeData());
+	}
+
+	template<typename NodeData> SplayTree<NodeData>::SplayTree(NodeData rootVal) : BinaryTree<NodeData>(rootVal) {
+		nodeCount = 1;
+		header = new BNode<NodeData>(NodeData());
+	}
+
+	// a splay tree can degenerate into a long path, so nodes are freed
+	// iteratively here instead of through the recursive Node destructor
+	template<typename NodeData> SplayTree<NodeData>::~SplayTree() {
+		std::vector<BNode<NodeData>*> pending;
+		if (SplayTree<NodeData>::root != NULL) pending.push_back(SplayTree<NodeData>::getRootNode());
+
+		while (!pending.empty()) {
+			BNode<NodeData>* n = pending.back();
+			pending.pop_back();
+			if (n->hasLeftChild()) pending.push_back(n->left());
+			if (n->hasRightChild()) pending.push_back(n->right());
+			n->linkLeftChild(NULL);
+			n->linkRightChild(NULL);
+			delete n;
+		}
+
+		SplayTree<NodeData>::root = NULL;
+		delete header;
+	}
+
+	// getters and setters
+
+	template<typename NodeData> int SplayTree<NodeData>::getNodeCount() {
+		return nodeCount;
+	}
+
+	// utility methods
+
+	template<typename NodeData> BNode<NodeData>* SplayTree<NodeData>::insert(NodeData val) {
+		BNode<NodeData>* t = splay(SplayTree<NodeData>::getRootNode(), val);
+		SplayTree<NodeData>::root = t;
+
+		// already present, it is at the root now
+		if (t != NULL && !(val < t->getValue()) && !(t->getValue() < val)) return t;
+
+		return attachAtRoot(new BNode<NodeData>(val));
+	}
+
+	template<typename NodeData> BNode<NodeData>* SplayTree<NodeData>::insert(BNode<NodeData>* node) {
+		NodeData key = node->getValue();
+		BNode<NodeData>* t = splay(SplayTree<NodeData>::getRootNode(), key);
+		SplayTree<NodeData>::root = t;
+
+		// duplicate, tree unchanged and node not taken over
+		if (t != NULL && !(key < t->getValue()) && !(t->getValue() < key)) return NULL;
+
+		return attachAtRoot(node);
+	}
+
+	template<typename NodeData> BNode<NodeData>* SplayTree<NodeData>::find(NodeData key) {
+		BNode<NodeData>* t = splay(SplayTree<NodeData>::getRootNode(), key);
+		SplayTree<NodeData>::root = t;
+		if (t == NULL || key < t->getValue() || t->getValue() < key) return NULL;
+		return t;
+	}
+
+	template<typename NodeData> bool SplayTree<NodeData>::contains(NodeData key) {
+		return find(key) != NULL;
+	}
+
+	template<typename NodeData> bool SplayTree<NodeData>::remove(NodeData key) {
+		BNode<NodeData>* t = find(key);
+		if (t == NULL) return false;
+
+		BNode<NodeData>* left = t->left();
+		BNode<NodeData>* right = t->right();
+
+		if (left == NULL) {
+			SplayTree<NodeData>::root = right;
+		}
+		else {
+			// every key in left is < key, so splaying for key brings up its maximum,
+			// which then has no right child to take the right subtree
+			left = splay(left, key);
+			left->linkRightChild(right);
+			SplayTree<NodeData>::root = left;
+		}
+
+		t->linkLeftChild(NULL);
+		t->linkRightChild(NULL);
+		delete t;
+		nodeCount -= 1;
+		return true;
+	}
+
+	// private helpers
+
+	// root has just been splayed for node's key (and does not hold it):
+	// root is key's neighbour, so node takes its place and splits it
+	template<typename NodeData> BNode<NodeData>* SplayTree<NodeData>::attachAtRoot(BNode<NodeData>* node) {
+		BNode<NodeData>* t = SplayTree<NodeData>::getRootNode();
+
+		if (t != NULL) {
+			if (node->getValue() < t->getValue()) {
+				node->linkLeftChild(t->left());
+				node->linkRightChild(t);
+				t->linkLeftChild(NULL);
+			}
+			else {
+				node->linkRightChild(t->right());
+				node->linkLeftChild(t);
+				t->linkRightChild(NULL);
+			}
+		}
+
+		nodeCount += 1;
+		SplayTree<NodeData>::root = node;
+		return node;
+	}
+
+	template<typename NodeData> BNode<NodeData>* SplayTree<NodeData>::splay(BNode<NodeData>* t, NodeData key) {
+		if (t == NULL) return NULL;
+
+		// header->right collects the left tree, header->left the right tree;
+		// l / r are the attachment points (max of left tree / min of right tree)
+		header->linkLeftChild(NULL);
+		header->linkRightChild(NULL);
+		BNode<NodeData>* l = header;
+		BNode<NodeData>* r = header;
+
+		while (true) {
+			NodeData value = t->getValue();
+
+			if (key < value) {
+				BNode<NodeData>* child = t->left();
+				if (child == NULL) break;
+
+				// zig-zig: rotate right first
+				if (key < child->getValue()) {
+					t->linkLeftChild(child->right());
+					child->linkRightChild(t);
+					t = child;
+					if (!t->hasLeftChild()) break;
+				}
+
+				// link t into the right tree
+				r->linkLeftChild(t);
+				r = t;
+				t = t->left();
+			}
+			else if (value < key) {
+				BNode<NodeData>* child = t->right();
+				if (child == NULL) break;
+
+				// zag-zag: rotate left first
+				if (child->getValue() < key) {
+					t->linkRightChild(child->left());
+					child->linkLeftChild(t);
+					t = child;
+					if (!t->hasRightChild()) break;
+				}
+
+				// link t into the left tree
+				l->linkRightChild(t);
+				l = t;
+				t = t->right();
+			}
+			else break;
+		}
+
+		// reassemble
+		l->linkRightChild(t->left());
+		r->linkLeftChild(t->right());
+		t->linkLeftChild(header->right());
+		t->linkRightChild(header->left());
+
+		// the header must not keep pointers into the tree (its destructor would free them)
+		header->linkLeftChild(NULL);
+		header->linkRightChild(NULL);
+		return t;
+	}
+}
@@ -1,4 +1,4 @@
-﻿
+﻿#pragma once
 #include <vector>
 #include <map>
 
@@ -48,11 +48,11 @@ namespace Tree {
 	}	
 	
 	template<typename NodeData> Tree<NodeData>::Tree(Node<NodeData>* root) {
-		this.root = root;
+		this->root = root;
 	}
 
 	template<typename NodeData> Tree<NodeData>::Tree(NodeData rootVal) {
-		this.root = new Node<NodeData>(rootVal);
+		this->root = new Node<NodeData>(rootVal);
 	}
 	
 	template<typename NodeData> Tree<NodeData>::~Tree() {
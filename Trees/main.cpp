@@ -1,4 +1,9 @@
 #define TREE_BINARY__TEST_1
+//#define TREE_RANGE__TEST_1
+//#define TREE_COLUMN__TEST_1
+//#define TREE_LOUDS__TEST_1
+//#define TREE_SPLAY__TEST_1
+//#define TREE_SPLAY__BENCH_1
 
 
 #ifdef TREE_BINARY__TEST_1
@@ -36,4 +41,216 @@ int main() {
 	//~node();
 }
 
+#endif
+
+
+#ifdef TREE_RANGE__TEST_1
+
+#include <iostream>
+#include <vector>
+#include "SegmentTree.h"
+#include "FenwickTree.h"
+
+int main() {
+	std::vector<int> values = { 5, 3, 8, 6, 1, 4, 7, 2 };
+
+	Tree::SegmentTree<int> sums = Tree::SegmentTree<int>(values);
+	Tree::SegmentTree<int, Tree::MinMonoid<int>> mins = Tree::SegmentTree<int, Tree::MinMonoid<int>>(values);
+
+	std::cout << "sum [2, 6) = " << sums.query(2, 6) << std::endl;		// 19
+	std::cout << "min [2, 6) = " << mins.query(2, 6) << std::endl;		// 1
+
+	sums.assign(1, 5, 10);
+	mins.assign(1, 5, 10);
+	sums.printTree();
+	std::cout << "sum [0, 8) = " << sums.queryAll() << std::endl;		// 58
+	std::cout << "min [0, 4) = " << mins.query(0, 4) << std::endl;		// 5
+
+	std::cout << std::endl;
+
+	Tree::FenwickTree<int> bit = Tree::FenwickTree<int>(values);
+
+	bit.add(2, 7, 3);
+	bit.add(0, -5);
+	bit.printTree();
+	std::cout << "sum [2, 6) = " << bit.query(2, 6) << std::endl;		// 31
+	std::cout << "prefix 8 = " << bit.prefix(8) << std::endl;			// 46
+}
+
+#endif
+
+
+#ifdef TREE_COLUMN__TEST_1
+
+#include <iostream>
+#include "BNode.h"
+#include "BinaryTree.h"
+#include "ColumnTree.h"
+
+int main() {
+	Tree::BinaryTree<int> btree = Tree::BinaryTree<int>(1);
+	for (int i = 2; i <= 10; i++) btree.insert(i);
+
+	Tree::ColumnTree<int> ctree = Tree::ColumnTree<int>(&btree);
+	ctree.printTree();
+
+	std::cout << "nodes: " << ctree.getNodeCount() << std::endl;								// 10
+	std::cout << "sum: " << ctree.sumValues() << std::endl;										// 55
+	std::cout << "even: " << ctree.countValues([](int v) { return v % 2 == 0; }) << std::endl;	// 5
+	std::cout << "height: " << ctree.getNodeHeight(ctree.getRootNode()) << std::endl;			// 3
+	std::cout << "level of 9: " << ctree.getNodeLevel(8) << std::endl;							// 3
+
+	// back to linked nodes
+	Tree::Tree<int>* tree = ctree.toTree();
+	tree->printVisual();
+	delete tree;
+}
+
+#endif
+
+
+#ifdef TREE_LOUDS__TEST_1
+
+#include <iostream>
+#include "Node.h"
+#include "LoudsTree.h"
+
+int main() {
+	// general-arity tree: 1 -> (2 -> (5, 6, 7), 3, 4 -> (8 -> (9)))
+	Tree::Node<int>* root = new Tree::Node<int>(1);
+	Tree::Node<int>* a = new Tree::Node<int>(2);
+	Tree::Node<int>* c = new Tree::Node<int>(4);
+	Tree::Node<int>* d = new Tree::Node<int>(8);
+	root->addSubNode(a);
+	root->addSubNode(new Tree::Node<int>(3));
+	root->addSubNode(c);
+	a->addSubNode(new Tree::Node<int>(5));
+	a->addSubNode(new Tree::Node<int>(6));
+	a->addSubNode(new Tree::Node<int>(7));
+	c->addSubNode(d);
+	d->addSubNode(new Tree::Node<int>(9));
+
+	Tree::LoudsTree<int> ltree = Tree::LoudsTree<int>(root);
+	delete root;
+
+	ltree.printTree();
+
+	Tree::LoudsTree<int>::Index n = ltree.getSubNode(ltree.getRootNode(), 0);		// 2
+	std::cout << "sub-nodes of " << ltree.getValue(n) << ": " << ltree.getSubNodeCount(n) << std::endl;	// 3
+	std::cout << "next sibling: " << ltree.getValue(ltree.getNextSibling(n)) << std::endl;				// 3
+	std::cout << "first sub-node: " << ltree.getValue(ltree.getFirstSubNode(n)) << std::endl;				// 5
+	std::cout << "parent of 9: " << ltree.getValue(ltree.getParent(8)) << std::endl;						// 8
+	std::cout << "level of 9: " << ltree.getNodeLevel(8) << std::endl;									// 3
+	std::cout << "height: " << ltree.getNodeHeight(ltree.getRootNode()) << std::endl;					// 3
+	std::cout << "topology bytes: " << ltree.getTopologyBytes() << std::endl;
+}
+
+#endif
+
+
+#ifdef TREE_SPLAY__TEST_1
+
+#include <iostream>
+#include "BNode.h"
+#include "SplayTree.h"
+
+int main() {
+	Tree::SplayTree<int> stree = Tree::SplayTree<int>();
+
+	int keys[] = { 50, 30, 70, 20, 40, 60, 80 };
+	for (int k : keys) stree.insert(k);
+	stree.printVisual();
+
+	// the accessed key moves to the root
+	stree.find(20);
+	std::cout << "root after find(20): " << stree.getRootNode()->getValue() << std::endl;	// 20
+	stree.printVisual();
+
+	stree.remove(50);
+	std::cout << "contains 50: " << stree.contains(50) << std::endl;						// 0
+	std::cout << "nodes: " << stree.getNodeCount() << std::endl;							// 6
+	stree.printTree();
+}
+
+#endif
+
+
+#ifdef TREE_SPLAY__BENCH_1
+
+// SplayTree vs a balanced BST (std::set, red-black) on Zipf-distributed lookups.
+// Build with optimizations (Release) for meaningful numbers.
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include "BNode.h"
+#include "SplayTree.h"
+
+// ranks 0..n-1 with P(rank k) ~ 1 / (k + 1)^s, sampled by binary search on the CDF
+std::vector<int> zipfSample(int n, double s, int samples, std::mt19937& rng) {
+	std::vector<double> cdf(n);
+	double total = 0;
+	for (int k = 0; k < n; k++) {
+		total += 1.0 / std::pow(k + 1.0, s);
+		cdf[k] = total;
+	}
+	std::uniform_real_distribution<double> uniform(0.0, total);
+	std::vector<int> ranks(samples);
+	for (int i = 0; i < samples; i++) {
+		ranks[i] = (int) (std::upper_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+		if (ranks[i] == n) ranks[i] = n - 1;
+	}
+	return ranks;
+}
+
+template<typename Lookup> double timeLookups(const std::vector<int>& lookups, Lookup lookup, long long& found) {
+	auto start = std::chrono::steady_clock::now();
+	for (int key : lookups) found += lookup(key);
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+	const int KEYS = 200000;
+	const int LOOKUPS = 2000000;
+
+	std::mt19937 rng(12345);
+
+	// shuffled keys, so hot ranks are spread over the key space
+	std::vector<int> keys(KEYS);
+	for (int i = 0; i < KEYS; i++) keys[i] = 2 * i;
+	std::shuffle(keys.begin(), keys.end(), rng);
+
+	Tree::SplayTree<int> stree = Tree::SplayTree<int>();
+	std::set<int> balanced;
+	for (int k : keys) {
+		stree.insert(k);
+		balanced.insert(k);
+	}
+
+	double exponents[] = { 0.0, 0.8, 1.0, 1.2 };		// 0.0 is uniform
+	for (double s : exponents) {
+		std::vector<int> ranks = zipfSample(KEYS, s, LOOKUPS, rng);
+		std::vector<int> lookups(LOOKUPS);
+		for (int i = 0; i < LOOKUPS; i++) lookups[i] = keys[ranks[i]];
+
+		long long foundSplay = 0;
+		long long foundSet = 0;
+		double splayMs = timeLookups(lookups, [&](int k) { return stree.contains(k) ? 1 : 0; }, foundSplay);
+		double setMs = timeLookups(lookups, [&](int k) { return balanced.count(k) ? 1 : 0; }, foundSet);
+
+		std::cout << "zipf s=" << s
+			<< "  splay: " << splayMs << " ms"
+			<< "  std::set: " << setMs << " ms"
+			<< "  (found " << foundSplay << " / " << foundSet << ")" << std::endl;
+	}
+
+	// nodes print on deletion, keep that out of the results
+	std::cout.setstate(std::ios::failbit);
+}
+
 #endif
\ No newline at end of file